@@ -1,7 +1,7 @@
 /*
 	Date: April 19, 2011
 	File Name: PriorityQueue.c
-	Version: 1.02
+	Version: 1.03
 	IDE: Visual Studio 2010 Professional
 	Compiler: C89
 
@@ -17,10 +17,243 @@
 	#include "stdlib.h"
 #endif // end of USE_MALLOC
 
+#if (USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+	/*
+		Moves Chunk from the chunk directory list for its current NodesUsed
+		to the front of the list for NodesUsed.
+	*/
+	static void PriorityQueueMoveChunk(PRIORITY_QUEUE *PriorityQueue, PRIORITY_QUEUE_CHUNK *Chunk, UINT32 NodesUsed)
+	{
+		if(Chunk->Previous)
+			Chunk->Previous->Next = (PRIORITY_QUEUE_CHUNK*)(Chunk->Next);
+		else
+			PriorityQueue->Chunks[Chunk->NodesUsed] = (PRIORITY_QUEUE_CHUNK*)(Chunk->Next);
+
+		if(Chunk->Next)
+			Chunk->Next->Previous = (PRIORITY_QUEUE_CHUNK*)(Chunk->Previous);
+
+		Chunk->NodesUsed = (UINT32)NodesUsed;
+		Chunk->Previous = (PRIORITY_QUEUE_CHUNK*)NULL;
+		Chunk->Next = (PRIORITY_QUEUE_CHUNK*)(PriorityQueue->Chunks[NodesUsed]);
+
+		if(Chunk->Next)
+			Chunk->Next->Previous = (PRIORITY_QUEUE_CHUNK*)Chunk;
+
+		PriorityQueue->Chunks[NodesUsed] = (PRIORITY_QUEUE_CHUNK*)Chunk;
+	}
+
+	static PRIORITY_QUEUE_NODE *PriorityQueueChunkTakeNode(PRIORITY_QUEUE *PriorityQueue, PRIORITY_QUEUE_CHUNK *Chunk)
+	{
+		PRIORITY_QUEUE_NODE *Node;
+
+		if(Chunk->FreeNodes)
+		{
+			Node = (PRIORITY_QUEUE_NODE*)(Chunk->FreeNodes);
+			Chunk->FreeNodes = (PRIORITY_QUEUE_NODE*)(Node->Next);
+		}
+		else
+		{
+			// nodes are handed out in order so a new chunk never has to be initialized up front
+			Node = (PRIORITY_QUEUE_NODE*)&(Chunk->Nodes[Chunk->NodesTouched++]);
+		}
+
+		Node->Chunk = (PRIORITY_QUEUE_CHUNK*)Chunk;
+
+		PriorityQueueMoveChunk(PriorityQueue, Chunk, Chunk->NodesUsed + 1);
+
+		return (PRIORITY_QUEUE_NODE*)Node;
+	}
+
+	static void PriorityQueueReleaseChunks(PRIORITY_QUEUE *PriorityQueue)
+	{
+		PRIORITY_QUEUE_CHUNK *Chunk;
+		UINT32 i;
+
+		for(i = 0; i <= (UINT32)PRIORITY_QUEUE_CHUNK_SIZE; i++)
+		{
+			while(PriorityQueue->Chunks[i] != (PRIORITY_QUEUE_CHUNK*)NULL)
+			{
+				Chunk = (PRIORITY_QUEUE_CHUNK*)(PriorityQueue->Chunks[i]);
+				PriorityQueue->Chunks[i] = (PRIORITY_QUEUE_CHUNK*)(Chunk->Next);
+
+				PQueueMemDealloc((void*)Chunk);
+			}
+		}
+
+		PriorityQueue->ChunkCount = (UINT64)0;
+	}
+#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
+
+/*
+	Every PRIORITY_QUEUE_NODE is allocated and released through these two
+	methods.  With chunked storage each call does work bounded by
+	PRIORITY_QUEUE_CHUNK_SIZE and at most one PQueueMemAlloc() or
+	PQueueMemDealloc() of a single chunk.  The remove that empties the
+	PRIORITY_QUEUE also releases the spare chunk, see PriorityQueueRemove().
+*/
+static PRIORITY_QUEUE_NODE *PriorityQueueNodeAlloc(PRIORITY_QUEUE *PriorityQueue)
+{
+	#if (USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+		PRIORITY_QUEUE_CHUNK *Chunk;
+		UINT32 i;
+
+		// take from the fullest chunk that isn't full, so the emptier chunks can drain
+		for(i = (UINT32)PRIORITY_QUEUE_CHUNK_SIZE - 1; i > 0; i--)
+		{
+			if(PriorityQueue->Chunks[i])
+				return PriorityQueueChunkTakeNode(PriorityQueue, PriorityQueue->Chunks[i]);
+		}
+
+		// then the spare chunk
+		if(PriorityQueue->Chunks[0])
+			return PriorityQueueChunkTakeNode(PriorityQueue, PriorityQueue->Chunks[0]);
+
+		if((Chunk = (PRIORITY_QUEUE_CHUNK*)PQueueMemAlloc(sizeof(PRIORITY_QUEUE_CHUNK))) == (PRIORITY_QUEUE_CHUNK*)NULL)
+			return (PRIORITY_QUEUE_NODE*)NULL;
+
+		Chunk->FreeNodes = (PRIORITY_QUEUE_NODE*)NULL;
+		Chunk->NodesUsed = Chunk->NodesTouched = (UINT32)0;
+		Chunk->Previous = (PRIORITY_QUEUE_CHUNK*)NULL;
+		Chunk->Next = (PRIORITY_QUEUE_CHUNK*)NULL;
+
+		PriorityQueue->Chunks[0] = (PRIORITY_QUEUE_CHUNK*)Chunk;
+		PriorityQueue->ChunkCount++;
+
+		return PriorityQueueChunkTakeNode(PriorityQueue, Chunk);
+	#else
+		(void)PriorityQueue;
+
+		return (PRIORITY_QUEUE_NODE*)PQueueMemAlloc(sizeof(PRIORITY_QUEUE_NODE));
+	#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
+}
+
+/*
+	Returns TRUE if a chunk was released with PQueueMemDealloc().
+*/
+static BOOL PriorityQueueNodeDealloc(PRIORITY_QUEUE *PriorityQueue, PRIORITY_QUEUE_NODE *Node)
+{
+	#if (USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+		PRIORITY_QUEUE_CHUNK *Chunk;
+
+		Chunk = (PRIORITY_QUEUE_CHUNK*)(Node->Chunk);
+
+		// a NULL Chunk marks the node as free for PriorityQueueCompact()
+		Node->Chunk = (PRIORITY_QUEUE_CHUNK*)NULL;
+		Node->Next = (PRIORITY_QUEUE_NODE*)(Chunk->FreeNodes);
+		Chunk->FreeNodes = (PRIORITY_QUEUE_NODE*)Node;
+
+		/*
+			While the PRIORITY_QUEUE isn't empty keep one empty chunk
+			around, so a PRIORITY_QUEUE hovering around a chunk boundary
+			doesn't allocate and release a chunk on every add and remove.
+		*/
+		if(Chunk->NodesUsed == (UINT32)1 && (PriorityQueue->Chunks[0] || PriorityQueue->Size == (UINT64)0))
+		{
+			PriorityQueueMoveChunk(PriorityQueue, Chunk, (UINT32)0);
+			PriorityQueue->Chunks[0] = (PRIORITY_QUEUE_CHUNK*)(Chunk->Next);
+
+			if(PriorityQueue->Chunks[0])
+				PriorityQueue->Chunks[0]->Previous = (PRIORITY_QUEUE_CHUNK*)NULL;
+
+			PriorityQueue->ChunkCount--;
+
+			PQueueMemDealloc((void*)Chunk);
+
+			return (BOOL)TRUE;
+		}
+
+		PriorityQueueMoveChunk(PriorityQueue, Chunk, Chunk->NodesUsed - 1);
+
+		return (BOOL)FALSE;
+	#else
+		(void)PriorityQueue;
+
+		PQueueMemDealloc((void*)Node);
+
+		return (BOOL)TRUE;
+	#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
+}
+
+#if (USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+	/*
+		Nodes are handed out in the order they're added but removed in
+		priority order, so chunks rarely empty on their own.  Once at
+		least two chunks worth of nodes are free this moves one node out
+		of the emptiest chunk into the fullest chunk that isn't full, so
+		that chunk empties in fewer than PRIORITY_QUEUE_CHUNK_SIZE removes
+		and is released.  While removes continue, the free nodes retained
+		settle at a few chunks worth regardless of the PRIORITY_QUEUE's
+		peak size.
+	*/
+	static void PriorityQueueCompact(PRIORITY_QUEUE *PriorityQueue)
+	{
+		PRIORITY_QUEUE_CHUNK *From, *To;
+		PRIORITY_QUEUE_NODE *Node, *NewNode;
+		UINT32 i, j;
+
+		if((UINT64)(PriorityQueue->ChunkCount) * (UINT64)PRIORITY_QUEUE_CHUNK_SIZE - (UINT64)(PriorityQueue->Size) < (UINT64)(2 * PRIORITY_QUEUE_CHUNK_SIZE))
+			return;
+
+		for(i = 1; i < (UINT32)PRIORITY_QUEUE_CHUNK_SIZE; i++)
+		{
+			if(PriorityQueue->Chunks[i])
+				break;
+		}
+
+		if(i == (UINT32)PRIORITY_QUEUE_CHUNK_SIZE)
+			return;
+
+		From = (PRIORITY_QUEUE_CHUNK*)(PriorityQueue->Chunks[i]);
+		To = (PRIORITY_QUEUE_CHUNK*)(From->Next);
+
+		for(j = (UINT32)PRIORITY_QUEUE_CHUNK_SIZE - 1; j > i; j--)
+		{
+			if(PriorityQueue->Chunks[j])
+			{
+				To = (PRIORITY_QUEUE_CHUNK*)(PriorityQueue->Chunks[j]);
+				break;
+			}
+		}
+
+		// From is the only chunk in use, moving into the spare chunk gains nothing
+		if(To == (PRIORITY_QUEUE_CHUNK*)NULL)
+			return;
+
+		for(j = 0; From->Nodes[j].Chunk == (PRIORITY_QUEUE_CHUNK*)NULL; j++);
+
+		Node = (PRIORITY_QUEUE_NODE*)&(From->Nodes[j]);
+		NewNode = PriorityQueueChunkTakeNode(PriorityQueue, To);
+
+		NewNode->Data = (void*)(Node->Data);
+		NewNode->Next = (PRIORITY_QUEUE_NODE*)(Node->Next);
+		NewNode->Previous = (PRIORITY_QUEUE_NODE*)(Node->Previous);
+
+		#if(USING_PRIORITY_QUEUE_KEY_PREFIX == 1)
+			NewNode->KeyPrefix = (UINT64)(Node->KeyPrefix);
+		#endif // end of USING_PRIORITY_QUEUE_KEY_PREFIX
+
+		if(NewNode->Previous)
+			NewNode->Previous->Next = (PRIORITY_QUEUE_NODE*)NewNode;
+		else
+			PriorityQueue->Head = (PRIORITY_QUEUE_NODE*)NewNode;
+
+		if(NewNode->Next)
+			NewNode->Next->Previous = (PRIORITY_QUEUE_NODE*)NewNode;
+		else
+			PriorityQueue->Tail = (PRIORITY_QUEUE_NODE*)NewNode;
+
+		PriorityQueueNodeDealloc(PriorityQueue, Node);
+	}
+#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
+
 PRIORITY_QUEUE *CreatePriorityQueue(PRIORITY_QUEUE *PriorityQueue, INT32 (*CompareTo)(const void *Data1, const void *Data2), void (*CustomFreeMethod)(void *Data))
 {
 	PRIORITY_QUEUE *TempPriorityQueue;
 
+	#if (USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+		UINT32 i;
+	#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
+
 	#if (PRIORITY_QUEUE_SAFE_MODE == 1)
 		if(CompareTo == (INT32(*)(const void *, const void *))NULL)
 			return (PRIORITY_QUEUE*)NULL;
@@ -40,7 +273,18 @@ PRIORITY_QUEUE *CreatePriorityQueue(PRIORITY_QUEUE *PriorityQueue, INT32 (*Compa
 
 	TempPriorityQueue->CompareTo = (INT32(*)(const void *, const void *))CompareTo;
 	TempPriorityQueue->Head = TempPriorityQueue->Tail = (PRIORITY_QUEUE_NODE*)NULL;
-	TempPriorityQueue->Size = (UINT32)0;
+	TempPriorityQueue->Size = (UINT64)0;
+
+	#if(USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+		for(i = 0; i <= (UINT32)PRIORITY_QUEUE_CHUNK_SIZE; i++)
+			TempPriorityQueue->Chunks[i] = (PRIORITY_QUEUE_CHUNK*)NULL;
+
+		TempPriorityQueue->ChunkCount = (UINT64)0;
+	#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
+
+	#if(USING_PRIORITY_QUEUE_KEY_PREFIX == 1)
+		TempPriorityQueue->GetKeyPrefix = (UINT64(*)(const void *))NULL;
+	#endif // end of USING_PRIORITY_QUEUE_KEY_PREFIX
 
 	#if(USING_PRIORITY_QUEUE_DEPENDENT_FREE_METHOD == 1)
 		TempPriorityQueue->PriorityQueueFreeMethod = (void(*)(void *))CustomFreeMethod;
@@ -58,15 +302,22 @@ BOOL PriorityQueueAdd(PRIORITY_QUEUE *PriorityQueue, const void *Data)
 			return (BOOL)FALSE;
 	#endif // end of PRIORITY_QUEUE_SAFE_MODE
 
-	if((Node = (PRIORITY_QUEUE_NODE*)PQueueMemAlloc(sizeof(PRIORITY_QUEUE_NODE))) == (PRIORITY_QUEUE_NODE*)NULL)
+	if((Node = (PRIORITY_QUEUE_NODE*)PriorityQueueNodeAlloc(PriorityQueue)) == (PRIORITY_QUEUE_NODE*)NULL)
 		return (BOOL)FALSE;
 
 	Node->Data = (void*)Data;
 	Node->Next = Node->Previous = (PRIORITY_QUEUE_NODE*)NULL;
 
+	#if(USING_PRIORITY_QUEUE_KEY_PREFIX == 1)
+		if(PriorityQueue->GetKeyPrefix)
+			Node->KeyPrefix = (UINT64)(PriorityQueue->GetKeyPrefix((const void*)Data));
+		else
+			Node->KeyPrefix = (UINT64)0;
+	#endif // end of USING_PRIORITY_QUEUE_KEY_PREFIX
+
 	PriorityQueue->Size++;
 
-	if(PriorityQueue->Size == (UINT32)1)
+	if(PriorityQueue->Size == (UINT64)1)
 	{
 		PriorityQueue->Head = PriorityQueue->Tail = (PRIORITY_QUEUE_NODE*)Node;
 		return (BOOL)TRUE;
@@ -76,7 +327,22 @@ BOOL PriorityQueueAdd(PRIORITY_QUEUE *PriorityQueue, const void *Data)
 
 	do
 	{
-		if(PriorityQueue->CompareTo((void*)(TempNode->Data), (void*)(Node->Data)) > 0)
+		#if(USING_PRIORITY_QUEUE_KEY_PREFIX == 1)
+			/*
+				Only when the cached prefixes are equal do we need to call
+				CompareTo and touch the data itself.  With no GetKeyPrefix
+				method every prefix is 0, so CompareTo is always called.
+			*/
+			if(TempNode->KeyPrefix < Node->KeyPrefix)
+			{
+				TempNode = (PRIORITY_QUEUE_NODE*)(TempNode->Next);
+				continue;
+			}
+
+			if(TempNode->KeyPrefix > Node->KeyPrefix || PriorityQueue->CompareTo((void*)(TempNode->Data), (void*)(Node->Data)) > 0)
+		#else
+			if(PriorityQueue->CompareTo((void*)(TempNode->Data), (void*)(Node->Data)) > 0)
+		#endif // end of USING_PRIORITY_QUEUE_KEY_PREFIX
 		{
 			// we found a winner, we go before TempNode
 			if(TempNode->Previous)
@@ -129,7 +395,7 @@ void *PriorityQueueRemove(PRIORITY_QUEUE *PriorityQueue)
 	Node = (PRIORITY_QUEUE_NODE*)(PriorityQueue->Head);
 	PriorityQueue->Head = (PRIORITY_QUEUE_NODE*)(PriorityQueue->Head->Next);
 
-	if(PriorityQueue->Size == (UINT32)0)
+	if(PriorityQueue->Size == (UINT64)0)
 	{
 		PriorityQueue->Tail = (PRIORITY_QUEUE_NODE*)NULL;
 	}
@@ -138,11 +404,39 @@ void *PriorityQueueRemove(PRIORITY_QUEUE *PriorityQueue)
 		PriorityQueue->Head->Previous = (PRIORITY_QUEUE_NODE*)NULL;
 	}
 
-	PQueueMemDealloc((void*)Node);
+	#if (USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+		// only compact if no chunk was released yet
+		if(!PriorityQueueNodeDealloc(PriorityQueue, Node))
+			PriorityQueueCompact(PriorityQueue);
+
+		// the PRIORITY_QUEUE drained, hand the spare chunk back as well
+		if(PriorityQueue->Size == (UINT64)0)
+			PriorityQueueReleaseChunks(PriorityQueue);
+	#else
+		PriorityQueueNodeDealloc(PriorityQueue, Node);
+	#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
 
 	return (void*)Data;
 }
 
+#if (USING_PRIORITY_QUEUE_KEY_PREFIX == 1)
+	BOOL PriorityQueueSetKeyPrefixMethod(PRIORITY_QUEUE *PriorityQueue, UINT64 (*GetKeyPrefix)(const void *Data))
+	{
+		#if (PRIORITY_QUEUE_SAFE_MODE == 1)
+			if(PriorityQueueIsNull(PriorityQueue))
+				return (BOOL)FALSE;
+		#endif // end of PRIORITY_QUEUE_SAFE_MODE
+
+		// the cached prefixes of existing nodes would be stale
+		if(!PriorityQueueIsEmpty(PriorityQueue))
+			return (BOOL)FALSE;
+
+		PriorityQueue->GetKeyPrefix = (UINT64(*)(const void *))GetKeyPrefix;
+
+		return (BOOL)TRUE;
+	}
+#endif // end of USING_PRIORITY_QUEUE_KEY_PREFIX
+
 #if (USING_PRIORITY_QUEUE_PEEK_METHOD == 1)
 	void *PriorityQueuePeek(PRIORITY_QUEUE *PriorityQueue)
 	{
@@ -188,13 +482,20 @@ void *PriorityQueueRemove(PRIORITY_QUEUE *PriorityQueue)
 					PriorityQueue->PriorityQueueFreeMethod((void*)(Node->Data));
 				}
 			#endif // end of USING_PRIORITY_QUEUE_DEPENDENT_FREE_METHOD
-	
-			PQueueMemDealloc((void*)(Node));
+
+			// with chunked storage the nodes are released along with their chunks below
+			#if (USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 0)
+				PQueueMemDealloc((void*)(Node));
+			#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
 
 			Node = (PRIORITY_QUEUE_NODE*)(PriorityQueue->Head);
 		}
 
-		PriorityQueue->Size = (UINT32)0;
+		#if (USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+			PriorityQueueReleaseChunks(PriorityQueue);
+		#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
+
+		PriorityQueue->Size = (UINT64)0;
 		PriorityQueue->Tail = (PRIORITY_QUEUE_NODE*)NULL;
 
 		return (BOOL)TRUE;
@@ -202,49 +503,56 @@ void *PriorityQueueRemove(PRIORITY_QUEUE *PriorityQueue)
 #endif // end of USING_PRIORITY_QUEUE_CLEAR_METHOD
 
 #if (USING_PRIORITY_QUEUE_GET_SIZE_METHOD == 1)
-	UINT32 PriorityQueueGetSize(PRIORITY_QUEUE *PriorityQueue)
+	UINT64 PriorityQueueGetSize(PRIORITY_QUEUE *PriorityQueue)
 	{
 		#if (PRIORITY_QUEUE_SAFE_MODE == 1)
 			if(PriorityQueueIsNull(PriorityQueue))
-				return (UINT32)0;
+				return (UINT64)0;
 		#endif // end of PRIORITY_QUEUE_SAFE_MODE
 
-		return (UINT32)(PriorityQueue->Size);
+		return (UINT64)(PriorityQueue->Size);
 	}
 #endif // end of USING_PRIORITY_QUEUE_GET_SIZE_METHOD
 
 #if (USING_PRIORITY_QUEUE_GET_SIZE_IN_BYTES_METHOD == 1)
-	UINT32 PriorityQueueGetSizeInBytes(PRIORITY_QUEUE *PriorityQueue, UINT32 DataSizeInBytes)
+	UINT64 PriorityQueueGetSizeInBytes(PRIORITY_QUEUE *PriorityQueue, UINT32 DataSizeInBytes)
 	{
-		UINT32 Size;
+		UINT64 Size;
 
 		#if (PRIORITY_QUEUE_SAFE_MODE == 1)
 			if(PriorityQueueIsNull(PriorityQueue))
-				return (UINT32)0;
+				return (UINT64)0;
 		#endif // end of PRIORITY_QUEUE_SAFE_MODE
 
-		Size = (UINT32)sizeof(PRIORITY_QUEUE);
+		Size = (UINT64)sizeof(PRIORITY_QUEUE);
 	
 		if(PriorityQueueIsEmpty(PriorityQueue))
-			return (UINT32)Size;
+			return (UINT64)Size;
 
 		/*
 			If the user provided us with the size of their data in bytes
 			then we must use it to calculate the size of the PRIORITY_QUEUE in bytes.
 			Otherwise we just don't include it in the calculation.
 		*/
-		if(DataSizeInBytes)
-			Size += (UINT32)((UINT32)(PriorityQueue->Size) * (UINT32)((UINT32)DataSizeInBytes + (UINT32)sizeof(PRIORITY_QUEUE_NODE)));
-		else
-			Size += (UINT32)((UINT32)(PriorityQueue->Size) * (UINT32)sizeof(PRIORITY_QUEUE_NODE));
+		#if (USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+			Size += (UINT64)((UINT64)(PriorityQueue->ChunkCount) * (UINT64)sizeof(PRIORITY_QUEUE_CHUNK));
+
+			if(DataSizeInBytes)
+				Size += (UINT64)((UINT64)(PriorityQueue->Size) * (UINT64)DataSizeInBytes);
+		#else
+			if(DataSizeInBytes)
+				Size += (UINT64)((UINT64)(PriorityQueue->Size) * (UINT64)((UINT64)DataSizeInBytes + (UINT64)sizeof(PRIORITY_QUEUE_NODE)));
+			else
+				Size += (UINT64)((UINT64)(PriorityQueue->Size) * (UINT64)sizeof(PRIORITY_QUEUE_NODE));
+		#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
 
-		return (UINT32)Size;
+		return (UINT64)Size;
 	}
 #endif // end of USING_PRIORITY_QUEUE_GET_SIZE_IN_BYTES_METHOD
 
 #if (USING_PRIORITY_QUEUE_GET_LIBRARY_VERSION == 1)
 
-	const BYTE *PriorityQueueLibraryVersion[] = {"Priority Queue Lib v1.02\0"};
+	const BYTE *PriorityQueueLibraryVersion[] = {"Priority Queue Lib v1.03\0"};
 
 	const BYTE *PriorityQueueGetLibraryVersion(void)
 	{
@@ -1,7 +1,7 @@
 /*
 	Date: April 19, 2011
 	File Name: PriorityQueue.h
-	Version: 1.02
+	Version: 1.03
 	IDE: Visual Studio 2010 Professional
 	Compiler: C89
 
@@ -19,7 +19,7 @@
 /*! \mainpage Priority Queue Library
  *  \brief This is a Library written in C for manipulating a Priority Queue Data Structure.
  *  \author brodie
- *  \version 1.02
+ *  \version 1.03
  *  \date   April 19, 2011
  */
 
@@ -115,11 +115,46 @@ BOOL PriorityQueueAdd(PRIORITY_QUEUE *PriorityQueue, const void *Data);
 		* @param *PriorityQueue - The address of the PRIORITY_QUEUE that will have the data removed from it.
 		* @return *void - The address of the data located at the head of the specified PRIORITY_QUEUE, (void*)NULL otherwise.
 		* @note This method calls PQueueMemDealloc() to remove from memory the node in the PRIORITY_QUEUE pointing to the data.
+		With chunked storage the node is returned to its chunk and at most one node is moved between chunks, so each call
+		does bounded work and calls PQueueMemDealloc() on at most one chunk, or two when the PRIORITY_QUEUE drains.  An
+		empty PRIORITY_QUEUE holds no chunks.
 		* @sa PQueueMemDealloc()
 		* @since v1.0
 */
 void *PriorityQueueRemove(PRIORITY_QUEUE *PriorityQueue);
 
+/*
+	Function: BOOL PriorityQueueSetKeyPrefixMethod(PRIORITY_QUEUE *PriorityQueue, UINT64 (*GetKeyPrefix)(const void *Data))
+
+	Parameters: 
+		PRIORITY_QUEUE *PriorityQueue - The address of the PRIORITY_QUEUE that will use the key prefix method.
+
+		UINT64 (*GetKeyPrefix)(const void *Data) - A pointer to a method that returns an order preserving
+		64 bit prefix of Data.  If the prefix of Data1 is smaller than the prefix of Data2 then
+		CompareTo(Data1, Data2) must return a value < 0.  Pass NULL to stop using key prefixes.
+
+	Returns:
+		BOOL - TRUE if the operation was successful, FALSE otherwise.
+
+	Description: Sets the method used to compute the key prefix that is cached in each PRIORITY_QUEUE_NODE
+	when data is added.  PriorityQueueAdd() compares the cached prefixes first and only calls CompareTo
+	when two prefixes are equal.
+
+	Notes: The PRIORITY_QUEUE must be empty, otherwise FALSE is returned.
+*/
+/**
+		* @brief Sets the key prefix method of a PRIORITY_QUEUE.
+		* @param *PriorityQueue - The address of the PRIORITY_QUEUE that will use the key prefix method.
+		* @param *GetKeyPrefix - A method returning an order preserving 64 bit prefix of a piece of data, or NULL.
+		* @return BOOL - TRUE if the operation was successful, FALSE otherwise.
+		* @note The PRIORITY_QUEUE must be empty, otherwise FALSE is returned.
+		* @sa PriorityQueueAdd()
+		* @since v1.03
+*/
+#if (USING_PRIORITY_QUEUE_KEY_PREFIX == 1)
+	BOOL PriorityQueueSetKeyPrefixMethod(PRIORITY_QUEUE *PriorityQueue, UINT64 (*GetKeyPrefix)(const void *Data));
+#endif // end of USING_PRIORITY_QUEUE_KEY_PREFIX
+
 /*
 	Function: void *PriorityQueuePeek(PRIORITY_QUEUE *PriorityQueue)
 
@@ -167,7 +202,8 @@ void *PriorityQueueRemove(PRIORITY_QUEUE *PriorityQueue);
 		Otherwise put this variable to (BOOL)FALSE.
 		* @return BOOL - Returns (BOOL)TRUE if the operation was successful, meaning the PRIORITY_QUEUE is empty.  (BOOL)FALSE
 		otherwise.
-		* @note Will free data with user supplied method when PRIORITY_QUEUE was created.
+		* @note Will free data with user supplied method when PRIORITY_QUEUE was created.  With chunked storage this also
+		releases every chunk.
 		* @sa PQueueMemDealloc()
 		* @since v1.0
 */
@@ -176,14 +212,14 @@ void *PriorityQueueRemove(PRIORITY_QUEUE *PriorityQueue);
 #endif // end of USING_PRIORITY_QUEUE_CLEAR_METHOD
 
 /*
-	Function: UINT32 PriorityQueueGetSize(PRIORITY_QUEUE *PriorityQueue)
+	Function: UINT64 PriorityQueueGetSize(PRIORITY_QUEUE *PriorityQueue)
 
 	Parameters: 
 		PRIORITY_QUEUE *PriorityQueue - The address of the PRIORITY_QUEUE that will have its size returned.
 
 	Returns:
-		UINT32 - The size of the specified PRIORITY_QUEUE.  The size is determined by how many nodes are inside of
-		PRIORITY_QUEUE.  If there is an error with the PRIORITY_QUEUE then this method returns (UINT32)0.
+		UINT64 - The size of the specified PRIORITY_QUEUE.  The size is determined by how many nodes are inside of
+		PRIORITY_QUEUE.  If there is an error with the PRIORITY_QUEUE then this method returns (UINT64)0.
 
 	Description: Clears all data inside the PRIORITY_QUEUE, and sets the size back to 0.
 
@@ -192,42 +228,45 @@ void *PriorityQueueRemove(PRIORITY_QUEUE *PriorityQueue);
 /**
 		* @brief Returns the size of a PRIORITY_QUEUE.
 		* @param *PriorityQueue - The address of the PRIORITY_QUEUE that will have its size returned.
-		* @return UINT32 - The number of nodes present inside the specified PRIORITY_QUEUE.  If there are any errors
-		with the PRIORITY_QUEUE or it is empty, then (UINT32)0 is returned.
+		* @return UINT64 - The number of nodes present inside the specified PRIORITY_QUEUE.  If there are any errors
+		with the PRIORITY_QUEUE or it is empty, then (UINT64)0 is returned.
 		* @note None
 		* @sa None
 		* @since v1.0
 */
 #if (USING_PRIORITY_QUEUE_GET_SIZE_METHOD == 1)
-	UINT32 PriorityQueueGetSize(PRIORITY_QUEUE *PriorityQueue);
+	UINT64 PriorityQueueGetSize(PRIORITY_QUEUE *PriorityQueue);
 #endif // end of USING_PRIORITY_QUEUE_GET_SIZE_METHOD
 
 /*
-	Function: UINT32 PriorityQueueGetSize(PRIORITY_QUEUE *PriorityQueue)
+	Function: UINT64 PriorityQueueGetSizeInBytes(PRIORITY_QUEUE *PriorityQueue, UINT32 DataSizeInBytes)
 
 	Parameters: 
-		PRIORITY_QUEUE *PriorityQueue - The address of the PRIORITY_QUEUE that will have its size returned.
+		PRIORITY_QUEUE *PriorityQueue - The address of the PRIORITY_QUEUE that will have its size in bytes returned.
+
+		UINT32 DataSizeInBytes - The size in bytes of the data each node points to, or 0 to leave the data out.
 
 	Returns:
-		UINT32 - The size of the specified PRIORITY_QUEUE.  The size is determined by how many nodes are inside of
-		PRIORITY_QUEUE.  If there is an error with the PRIORITY_QUEUE then this method returns (UINT32)0.
+		UINT64 - The size in bytes of the specified PRIORITY_QUEUE.  If there is an error with the PRIORITY_QUEUE
+		then this method returns (UINT64)0.
 
-	Description: Clears all data inside the PRIORITY_QUEUE, and sets the size back to 0.
+	Description: Returns the number of bytes used by the PRIORITY_QUEUE, its nodes and optionally its data.
 
 	Notes: None
 */
 /**
 		* @brief Returns the size in bytes of a PRIORITY_QUEUE.
 		* @param *PriorityQueue - The address of the PRIORITY_QUEUE that will have its size in bytes returned.
-		* @return UINT32 - The number of bytes minus the size of the head of the PRIORITY_QUEUE.  An empty PRIORITY_QUEUE
-		will return (UINT32)0.
+		* @return UINT64 - The number of bytes minus the size of the head of the PRIORITY_QUEUE.  An empty PRIORITY_QUEUE
+		will return (UINT64)0.
 		* @note This method calculates the size of the PRIORITY_QUEUE in bytes by knowing the size of the data stored in
-		each node, and the size of a node multiplied by the number of nodes held within the PRIORITY_QUEUE.
+		each node, and the size of a node multiplied by the number of nodes held within the PRIORITY_QUEUE.  With
+		chunked storage the size of every allocated chunk is counted instead of the size of each node.
 		* @sa None
 		* @since v1.0
 */
 #if (USING_PRIORITY_QUEUE_GET_SIZE_IN_BYTES_METHOD == 1)
-	UINT32 PriorityQueueGetSizeInBytes(PRIORITY_QUEUE *PriorityQueue, UINT32 DataSizeInBytes);
+	UINT64 PriorityQueueGetSizeInBytes(PRIORITY_QUEUE *PriorityQueue, UINT32 DataSizeInBytes);
 #endif // end of USING_PRIORITY_QUEUE_GET_SIZE_IN_BYTES_METHOD
 
 /*
@@ -300,6 +339,6 @@ void *PriorityQueueRemove(PRIORITY_QUEUE *PriorityQueue);
 
 	Notes: None
 */
-#define PriorityQueueIsEmpty(PriorityQueue)		(PriorityQueue->Size == (UINT32)0)
+#define PriorityQueueIsEmpty(PriorityQueue)		(PriorityQueue->Size == (UINT64)0)
 
 #endif // end of PRIORITY_QUEUE_H
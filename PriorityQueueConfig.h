@@ -1,7 +1,7 @@
 /*
 	Date: April 19, 2011
 	File Name: PriorityQueueConfig.h
-	Version: 1.02
+	Version: 1.03
 	IDE: Visual Studio 2010 Professional
 	Compiler: C89
 
@@ -23,6 +23,33 @@
 
 #define USING_PRIORITY_QUEUE_DEPENDENT_FREE_METHOD			1
 
+/**
+	*Set USING_PRIORITY_QUEUE_KEY_PREFIX to 1 to enable the
+	PriorityQueueSetKeyPrefixMethod() method.  Each PRIORITY_QUEUE_NODE
+	will then cache a 64 bit key prefix of its data, which is compared
+	before the CompareTo method is called.  This adds a UINT64 to
+	every PRIORITY_QUEUE_NODE.
+*/
+#define USING_PRIORITY_QUEUE_KEY_PREFIX						0
+
+/**
+	*Set USING_PRIORITY_QUEUE_CHUNKED_STORAGE to 1 to have the
+	PRIORITY_QUEUE_NODEs allocated from fixed size chunks of
+	PRIORITY_QUEUE_CHUNK_SIZE nodes instead of one PQueueMemAlloc()
+	call per node.  Chunks are allocated and released one at a
+	time through PQueueMemAlloc() and PQueueMemDealloc().
+
+	A non-empty PRIORITY_QUEUE holds at least one chunk,
+	sizeof(PRIORITY_QUEUE_CHUNK), and every PRIORITY_QUEUE carries
+	PRIORITY_QUEUE_CHUNK_SIZE + 1 chunk directory pointers.
+*/
+#define USING_PRIORITY_QUEUE_CHUNKED_STORAGE				0
+
+/**
+	*The number of PRIORITY_QUEUE_NODEs held in a single chunk.
+*/
+#define PRIORITY_QUEUE_CHUNK_SIZE							16
+
 /**
 	*Set USING_PRIORITY_QUEUE_GET_LIBRARY_VERSION to 1 to enable
 	the PriorityQueueGetLibraryVersion() method.
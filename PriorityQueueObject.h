@@ -1,7 +1,7 @@
 /*
 	Date: April 19, 2011
 	File Name: PriorityQueueObject.h
-	Version: 1.02
+	Version: 1.03
 	IDE: Visual Studio 2010 Professional
 	Compiler: C89
 
@@ -16,22 +16,58 @@
 #include "GenericTypes.h"
 #include "PriorityQueueConfig.h"
 
+#if(USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+	struct _PriorityQueueChunk;
+#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
+
 struct _PriorityQueueNode
 {
+	// first, so the 64 bit KeyPrefix doesn't leave a padding hole after Data
+	#if(USING_PRIORITY_QUEUE_KEY_PREFIX == 1)
+		UINT64 KeyPrefix;			// The cached key prefix of Data, see GetKeyPrefix.
+	#endif // end of USING_PRIORITY_QUEUE_KEY_PREFIX
+
 	void *Data;
 	struct _PriorityQueueNode *Next;
 	struct _PriorityQueueNode *Previous;
+
+	#if(USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+		struct _PriorityQueueChunk *Chunk;	// The chunk this node was allocated from, NULL while free.
+	#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
 };
 
 typedef struct _PriorityQueueNode PRIORITY_QUEUE_NODE;
 
+#if(USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+	struct _PriorityQueueChunk
+	{
+		struct _PriorityQueueChunk *Next;		// The next chunk with the same NodesUsed.
+		struct _PriorityQueueChunk *Previous;	// The previous chunk with the same NodesUsed.
+		PRIORITY_QUEUE_NODE *FreeNodes;			// Released nodes of this chunk, linked through Next.
+		UINT32 NodesUsed;						// The number of nodes of this chunk in the PRIORITY_QUEUE.
+		UINT32 NodesTouched;					// The number of nodes of this chunk ever handed out.
+		PRIORITY_QUEUE_NODE Nodes[PRIORITY_QUEUE_CHUNK_SIZE];
+	};
+
+	typedef struct _PriorityQueueChunk PRIORITY_QUEUE_CHUNK;
+#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
+
 struct _PriorityQueue
 {
 	// Attributes
-	UINT32 Size;					// The current Size of the PRIORITY_QUEUE.
+	UINT64 Size;					// The current Size of the PRIORITY_QUEUE.
 	PRIORITY_QUEUE_NODE *Head;		// A pointer to the beginning of the PRIORITY_QUEUE.
 	PRIORITY_QUEUE_NODE *Tail;		// A pointer to the end of the PRIORITY_QUEUE.
 
+	#if(USING_PRIORITY_QUEUE_CHUNKED_STORAGE == 1)
+		/*
+			The chunk directory.  Chunks[i] lists the chunks with i nodes
+			in use, Chunks[0] holds at most one empty spare chunk.
+		*/
+		PRIORITY_QUEUE_CHUNK *Chunks[PRIORITY_QUEUE_CHUNK_SIZE + 1];
+		UINT64 ChunkCount;					// The number of chunks in the chunk directory.
+	#endif // end of USING_PRIORITY_QUEUE_CHUNKED_STORAGE
+
 	// Methods
 
 	/*
@@ -41,6 +77,15 @@ struct _PriorityQueue
 	*/
 	INT32 (*CompareTo)(const void *Data1, const void *Data2);
 
+	#if(USING_PRIORITY_QUEUE_KEY_PREFIX == 1)
+		/*
+			Returns an order preserving 64 bit prefix of Data.  If the prefix of
+			Data1 is smaller than the prefix of Data2 then CompareTo(Data1, Data2)
+			must return < 0.  CompareTo is only called when two prefixes are equal.
+		*/
+		UINT64 (*GetKeyPrefix)(const void *Data);
+	#endif // end of USING_PRIORITY_QUEUE_KEY_PREFIX
+
 	#if(USING_PRIORITY_QUEUE_DEPENDENT_FREE_METHOD == 1)
 		void (*PriorityQueueFreeMethod)(void *Data);
 	#endif // USING_PRIORITY_QUEUE_DEPENDENT_FREE_METHOD